@@ -10,10 +10,10 @@ endif
 TARGET   := splitHaplotype
 SOURCES  := splitHaplotype.C
 
-SRC_INCDIRS  := .. ../AS_UTL ../stores ../utgcns
+SRC_INCDIRS  := .. ../AS_UTL ../stores ../utgcns ../meryl/libleaff ../meryl/libkmer
 
 TGT_LDFLAGS := -L${TARGET_DIR}/lib
-TGT_LDLIBS  := -lcanu
-TGT_PREREQS := libcanu.a
+TGT_LDLIBS  := -lleaff -lcanu
+TGT_PREREQS := libleaff.a libcanu.a
 
 SUBMAKEFILES :=
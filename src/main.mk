@@ -28,6 +28,8 @@ SOURCES      := AS_global.C \
                 \
                 AS_UTL/AS_UTL_fasta.C \
                 AS_UTL/AS_UTL_fileIO.C \
+                AS_UTL/gzipReader.C \
+                AS_UTL/gzipWriter.C \
                 AS_UTL/AS_UTL_reverseComplement.C \
                 AS_UTL/AS_UTL_stackTrace.C \
                 \
@@ -42,10 +44,14 @@ SOURCES      := AS_global.C \
                 AS_UTL/memoryMappedFile.C \
                 AS_UTL/mt19937ar.C \
                 AS_UTL/objectStore.C \
+                AS_UTL/perfStats.C \
+                AS_UTL/cpuDispatch.C \
                 AS_UTL/readBuffer.C \
+                AS_UTL/ringShop.C \
                 AS_UTL/speedCounter.C \
                 AS_UTL/sweatShop.C \
                 AS_UTL/timeAndSize.C \
+                AS_UTL/writeBufferAsync.C \
                 AS_UTL/kMer.C \
                 \
                 correction/computeGlobalScore.C \
@@ -57,6 +63,8 @@ SOURCES      := AS_global.C \
                 stores/sqStoreConstructor.C \
                 stores/sqStoreInfo.C \
                 stores/sqStoreEncode.C \
+                stores/sqStoreBlob.C \
+                stores/sqStoreReadCache.C \
                 stores/sqStorePartition.C \
                 \
                 stores/ovOverlap.C \
@@ -64,7 +72,9 @@ SOURCES      := AS_global.C \
                 stores/ovStoreWriter.C \
                 stores/ovStoreFilter.C \
                 stores/ovStoreFile.C \
+                stores/ovStoreFilePacked.C \
                 stores/ovStoreHistogram.C \
+                stores/ovStoreText.C \
                 \
                 stores/tgStore.C \
                 stores/tgTig.C \
@@ -88,6 +98,7 @@ SOURCES      := AS_global.C \
                 overlapInCore/liboverlap/prefixEditDistance-extend.C \
                 overlapInCore/liboverlap/prefixEditDistance-forward.C \
                 overlapInCore/liboverlap/prefixEditDistance-reverse.C \
+                overlapInCore/liboverlap/wavefrontEditDistance.C \
                 \
                 overlapInCore/libedlib/edlib.C \
                 \
@@ -110,6 +121,8 @@ SOURCES      := AS_global.C \
                 utgcns/libcns/abAbacus.C \
                 utgcns/libcns/abColumn.C \
                 utgcns/libcns/abMultiAlign.C \
+                utgcns/libcns/bandedAlign.C \
+                utgcns/libcns/flatAlnGraph.C \
                 utgcns/libcns/unitigConsensus.C \
                 utgcns/libpbutgcns/AlnGraphBoost.C  \
                 \
@@ -236,6 +249,10 @@ SUBMAKEFILES := stores/dumpBlob.mk \
                 erateEstimate/erateEstimate.mk \
                 \
                 utgcns/utgcns.mk \
+                utgcns/utgcnsBench.mk \
+                \
+                kernelBench/kernelBench.mk \
+                canuPlan/canuPlan.mk \
                 \
                 gfa/alignGFA.mk \
                 \
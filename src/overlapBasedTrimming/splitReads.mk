@@ -12,6 +12,7 @@ SOURCES  := splitReads.C \
             splitReads-workUnit.C \
             splitReads-subReads.C \
             splitReads-trimBad.C \
+            splitReads-splitRead.C \
             adjustNormal.C \
             adjustFlipped.C
 
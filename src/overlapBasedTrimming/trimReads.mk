@@ -11,7 +11,13 @@ TARGET   := trimReads
 SOURCES  := trimReads.C \
             trimReads-bestEdge.C \
             trimReads-largestCovered.C \
-            trimReads-quality.C
+            trimReads-quality.C \
+            splitReads-workUnit.C \
+            splitReads-subReads.C \
+            splitReads-trimBad.C \
+            splitReads-splitRead.C \
+            adjustNormal.C \
+            adjustFlipped.C
 
 SRC_INCDIRS  := .. ../AS_UTL ../stores
 
@@ -14,7 +14,8 @@ SOURCES  := findErrors.C \
             findErrors-Prefix_Edit_Distance.C \
             findErrors-Process_Olap.C \
             findErrors-Read_Frags.C \
-            findErrors-Read_Olaps.C
+            findErrors-Read_Olaps.C \
+            findErrors-Redo_Olaps.C
 
 SRC_INCDIRS  := .. ../AS_UTL ../stores ../overlapInCore/liboverlap
 
@@ -0,0 +1,291 @@
+#!/usr/bin/env perl
+
+###############################################################################
+ #
+ #  This file is part of canu, a software program that assembles whole-genome
+ #  sequencing reads into contigs.
+ #
+ #  This software is based on:
+ #    'Celera Assembler' (http://wgs-assembler.sourceforge.net)
+ #    the 'kmer package' (http://kmer.sourceforge.net)
+ #  both originally distributed by Applera Corporation under the GNU General
+ #  Public License, version 2.
+ #
+ #  Canu branched from Celera Assembler at its revision 4587.
+ #  Canu branched from the kmer project at its revision 1994.
+ #
+ #  File 'README.licenses' in the root directory of this distribution contains
+ #  full conditions and disclaimers for each license.
+ ##
+
+use strict;
+
+use Cwd qw(abs_path);
+use FindBin;
+use Time::HiRes qw(time);
+
+#  Assemble fixed simulated datasets with fixed parameters, and report the cost of each stage:
+#  wall and CPU time, peak memory and bytes read and written, summed over every run of each
+#  binary.  The numbers come from CANU_PERF_STATS (see AS_UTL/perfStats.H), so every binary
+#  reports for itself, however canu decides to run it.
+#
+#  The genome and reads depend only on the dataset name, so reports from different builds, or
+#  different machines, can be compared with -compare.  Overlaps are computed with overlapInCore,
+#  not mhap, so that java isn't part of the measurement.
+
+my %datasets = ( "bacterial"  => { genomeSize =>  5000000, seed => 1 },
+                 "chromosome" => { genomeSize => 50000000, seed => 2 } );
+
+my $readLength = 10000;
+my $coverage   = 25;
+my $errorM     = 0.01;    #  Mismatch, insertion and deletion rates for fastqSimulate;
+my $errorI     = 0.05;    #  about as noisy as raw PacBio.
+my $errorD     = 0.04;
+
+my @stages     = qw(sqStoreCreate meryl overlapInCore ovStoreBuild falconsense trimReads bogart utgcns);
+
+my $bin        = abs_path($FindBin::RealBin);
+my $dir        = "benchmark";
+my $threads    = 4;
+my $memory     = 16;
+my $compare    = undef;
+my @names;
+my $err        = 0;
+
+while (scalar(@ARGV) > 0) {
+    my $arg = shift @ARGV;
+
+    if    ($arg eq "-bin")       { $bin     = abs_path(shift @ARGV); }
+    elsif ($arg eq "-dir")       { $dir     = shift @ARGV;           }
+    elsif ($arg eq "-threads")   { $threads = shift @ARGV;           }
+    elsif ($arg eq "-memory")    { $memory  = shift @ARGV;           }
+    elsif ($arg eq "-compare")   { $compare = shift @ARGV;           }
+    elsif ($arg eq "-dataset")   { push @names, shift @ARGV;         }
+    else                         { print STDERR "ERROR: unknown option '$arg'\n";  $err++; }
+}
+
+foreach my $n (@names) {
+    if (!exists($datasets{$n})) {
+        print STDERR "ERROR: unknown dataset '$n'\n";
+        $err++;
+    }
+}
+
+if (($err > 0) || (scalar(@names) == 0)) {
+    print STDERR "usage: $0 [options] -dataset name [-dataset name ...]\n";
+    print STDERR "  -dataset name   'bacterial' (5 Mbp) or 'chromosome' (50 Mbp)\n";
+    print STDERR "  -bin dir        canu binaries; default: the directory this script is in\n";
+    print STDERR "  -dir dir        work directory; default 'benchmark'\n";
+    print STDERR "  -threads t      maxThreads for canu; default $threads\n";
+    print STDERR "  -memory g       maxMemory for canu, in GB; default $memory\n";
+    print STDERR "  -compare dir    also show the change from the reports in an earlier work directory\n";
+    print STDERR "\n";
+    print STDERR "Writes dir/name.report, one line per binary, with the number of runs, wall and CPU\n";
+    print STDERR "seconds, the largest peak RSS (bytes), and bytes read and written.\n";
+    exit(1);
+}
+
+system("mkdir -p $dir")  if (! -d $dir);
+
+$dir = abs_path($dir);
+
+
+
+#  A random genome, the same every time for the same seed.
+
+sub makeGenome ($$$) {
+    my ($file, $size, $seed) = @_;
+    my @acgt = ("A", "C", "G", "T");
+
+    return  if (-e $file);
+
+    srand($seed);
+
+    open(F, "> $file.WORKING") or die "can't open '$file.WORKING' for writing: $!\n";
+    print F ">genome\n";
+    for (my $bgn=0; $bgn < $size; $bgn += 100) {
+        my $len = ($bgn + 100 < $size) ? 100 : $size - $bgn;
+        my $seq = "";
+
+        $seq .= $acgt[int(rand(4))]  for (1..$len);
+
+        print F "$seq\n";
+    }
+    close(F);
+
+    rename("$file.WORKING", $file);
+}
+
+
+
+sub runCommand ($$) {
+    my ($cmd, $log) = @_;
+
+    print STDERR "-- $cmd\n";
+
+    if (system("$cmd > $log 2>&1") != 0) {
+        print STDERR "ERROR: failed; see '$log'.\n";
+        exit(1);
+    }
+}
+
+
+
+#  Sum the process stats over every run of each binary.
+
+sub loadStats ($) {
+    my $statsDir = shift @_;
+    my %stats;
+
+    opendir(D, $statsDir) or die "can't open '$statsDir': $!\n";
+    my @files = grep { m/\.tsv$/ } readdir(D);
+    closedir(D);
+
+    foreach my $f (@files) {
+        my %p;
+
+        open(F, "< $statsDir/$f") or die "can't open '$statsDir/$f': $!\n";
+        while (<F>) {
+            my ($type, $name, $field, $value) = split '\s+', $_;
+
+            $p{"name"}  = $name    if ($type eq "process");
+            $p{$field}  = $value   if ($type eq "process");
+        }
+        close(F);
+
+        next  if (!exists($p{"name"}));
+
+        my $s = $stats{$p{"name"}};
+
+        $s->{"runs"}++;
+        $s->{"wall"} += $p{"wallSeconds"};
+        $s->{"cpu"}  += $p{"cpuSeconds"};
+        $s->{"rss"}   = $p{"maxRSS"}  if ($s->{"rss"} < $p{"maxRSS"});
+        $s->{"read"} += $p{"ioReadBytes"};
+        $s->{"wrote"}+= $p{"ioWriteBytes"};
+
+        $stats{$p{"name"}} = $s;
+    }
+
+    return(\%stats);
+}
+
+
+
+sub loadReport ($) {
+    my $file = shift @_;
+    my %stats;
+
+    open(F, "< $file") or die "can't open '$file': $!\n";
+    while (<F>) {
+        next  if (m/^#/);
+
+        my ($name, $runs, $wall, $cpu, $rss, $read, $wrote) = split '\s+', $_;
+
+        $stats{$name} = { runs => $runs, wall => $wall, cpu => $cpu, rss => $rss, read => $read, wrote => $wrote };
+    }
+    close(F);
+
+    return(\%stats);
+}
+
+
+
+sub change ($$) {
+    my ($new, $old) = @_;
+
+    return("-")  if ((!defined($old)) || ($old == 0));
+
+    return(sprintf("%+.1f%%", 100.0 * ($new - $old) / $old));
+}
+
+
+
+foreach my $name (@names) {
+    my $d     = $datasets{$name};
+    my $wrk   = "$dir/$name";
+    my $stats = "$wrk/stats";
+
+    system("mkdir -p $wrk")  if (! -d $wrk);
+
+    #  Make the data, if it isn't there already.
+
+    makeGenome("$wrk/genome.fasta", $d->{genomeSize}, $d->{seed});
+
+    if (! -e "$wrk/reads.s.fastq") {
+        runCommand("$bin/fastqSimulate -f $wrk/genome.fasta -o $wrk/reads -se -l $readLength -x $coverage -em $errorM -ei $errorI -ed $errorD -seed $d->{seed}",
+                   "$wrk/reads.err");
+    }
+
+    #  Assemble it, from scratch, with every binary reporting stats to its own file.
+
+    system("rm -rf $wrk/asm $stats");
+    system("mkdir -p $stats");
+
+    $ENV{"CANU_PERF_STATS"} = "$stats/%p.%i.tsv";
+
+    my $bgn = time();
+
+    runCommand("$bin/canu -p asm -d $wrk/asm genomeSize=$d->{genomeSize} useGrid=false maxThreads=$threads maxMemory=$memory " .
+               "corOverlapper=ovl obtOverlapper=ovl utgOverlapper=ovl stopOnReadQuality=false " .
+               "-pacbio-raw $wrk/reads.s.fastq",
+               "$wrk/canu.out");
+
+    my $wall = time() - $bgn;
+
+    delete $ENV{"CANU_PERF_STATS"};
+
+    #  Report, the stages first, then everything else canu ran.
+
+    my $S = loadStats($stats);
+    my $O = (defined($compare) && (-e "$compare/$name.report")) ? loadReport("$compare/$name.report") : undef;
+
+    my @order = @stages;
+
+    foreach my $p (sort keys %$S) {
+        push @order, $p  if (!grep { $_ eq $p } @stages);
+    }
+
+    open(R, "> $dir/$name.report") or die "can't open '$dir/$name.report' for writing: $!\n";
+    print R "#  dataset $name genomeSize $d->{genomeSize} coverage $coverage readLength $readLength threads $threads memory $memory\n";
+    print R "#  total wall seconds ", sprintf("%.1f", $wall), "\n";
+    print R "#binary\truns\twallSeconds\tcpuSeconds\tmaxRSS\treadBytes\twriteBytes\n";
+
+    foreach my $p (@order) {
+        my $s = $S->{$p};
+
+        next  if (!defined($s));
+
+        printf R "%s\t%d\t%.2f\t%.2f\t%d\t%d\t%d\n", $p, $s->{runs}, $s->{wall}, $s->{cpu}, $s->{rss}, $s->{read}, $s->{wrote};
+    }
+    close(R);
+
+    print "\n";
+    print "$name:  total ", sprintf("%.1f", $wall), " seconds\n";
+    print "\n";
+
+    if (defined($O)) {
+        printf "%-28s %10s %8s  %10s %8s  %8s %8s\n", "binary", "wall", "change", "cpu", "change", "RSS MB", "change";
+    } else {
+        printf "%-28s %10s  %10s  %8s  %10s %10s\n", "binary", "wall", "cpu", "RSS MB", "read MB", "write MB";
+    }
+
+    foreach my $p (@order) {
+        my $s = $S->{$p};
+        my $o = (defined($O)) ? $O->{$p} : undef;
+
+        next  if (!defined($s));
+
+        if (defined($O)) {
+            printf "%-28s %10.2f %8s  %10.2f %8s  %8.1f %8s\n", $p,
+                   $s->{wall}, change($s->{wall}, $o->{wall}),
+                   $s->{cpu},  change($s->{cpu},  $o->{cpu}),
+                   $s->{rss} / 1048576, change($s->{rss}, $o->{rss});
+        } else {
+            printf "%-28s %10.2f  %10.2f  %8.1f  %10.1f %10.1f\n", $p,
+                   $s->{wall}, $s->{cpu}, $s->{rss} / 1048576, $s->{read} / 1048576, $s->{wrote} / 1048576;
+        }
+    }
+}
+
+exit(0);
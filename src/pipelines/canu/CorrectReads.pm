@@ -788,6 +788,7 @@ sub dumpCorrectedReads ($) {
         $cmd .= "  -o ./$asm.correctedReads.gz \\\n";
         $cmd .= "  -fasta \\\n";
         $cmd .= "  -nolibname \\\n";
+        $cmd .= "  -threads " . getGlobal("executiveThreads") . " \\\n";
         $cmd .= "> $asm.correctedReads.fasta.err 2>&1";
 
         if (runCommand(".", $cmd)) {
@@ -890,6 +890,9 @@ sub setDefaults () {
 
     #  ovbMemory and ovsMemory are set above.
 
+    setDefault("ovsMaxPerRead",      undef,     "Keep only the best this many overlaps for each read in the overlap store; default: unlimited");
+    setDefault("ovsMaxPerReadScore", "length",  "Score used to pick the best overlaps for ovsMaxPerRead: 'length' or 'matches' (length times identity)");
+
     #####  Executive
 
     setDefault("executiveMemory",   4,   "Amount of memory, in GB, to reserve for the Canu exective process");
@@ -906,6 +909,7 @@ sub setDefaults () {
     setDefault("obtErrorRate",       undef, "Stringency of overlaps to use for trimming");
     setDefault("trimReadsOverlap",   1,     "Minimum overlap between evidence to make contiguous trim; default '1'");
     setDefault("trimReadsCoverage",  1,     "Minimum depth of evidence to retain bases; default '1'");
+    setDefault("trimReadsSplit",     0,     "Split reads while trimming, in one pass over the overlaps; default 'false'");
 
     #$global{"splitReads..."}               = 1;
     #$synops{"splitReads..."}               = "";
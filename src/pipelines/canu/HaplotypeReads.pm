@@ -133,7 +133,7 @@ sub estimateMemoryNeededForHaplotypeJobs ($) {
 
        if (-e "haplotype/0-mercounts-$haplotype/$haplotype.ms$merSize.only.mcdat") {
           my $size = -s "haplotype/0-mercounts-$haplotype/$haplotype.ms$merSize.only.mcdat";
-          $memEst = int($size / 1073741824.0 + 0.5) * 2;
+          $memEst += int($size / 1073741824.0 + 0.5) * 2;    #  All haplotypes are loaded at once.
         }
         close(F);
     }
@@ -248,22 +248,19 @@ sub haplotypeConfigure ($) {
         print F "\n";
     }
 
-    print F "\n";
-    print F "\$bin/sqStoreDumpFASTQ \\\n";
-    print F "  -S \$seqStore \\\n";
-    print F "  -o ./results/\$jobid.fasta.WORKING \\\n";
-    print F "  -r \$bgn-\$end \\\n";
-    print F "  -fasta -nolibname -noreadname \\\n";
-    print F "  > ./results/\$jobid.err 2>&1 \\\n";
-    print F "&& \\\n";
-    print F "mv ./results/\$jobid.fasta.WORKING.fasta ./results/\$jobid.fasta \\\n";
-    print F "\n";
-
     my @haplotypes = getHaplotypes($base);
     my $merSize    = getGlobal("${tag}OvlMerSize");
     my $lo         = 0;
     my $hi         = 1000;
 
+    #  Classify reads straight from the store, with all haplotype kmers loaded at once.
+
+    print F "\n";
+    print F "\$bin/splitHaplotype \\\n";
+    print F "  -S \$seqStore \\\n";
+    print F "  -p results/\$jobid \\\n";
+    print F "  -m $merSize \\\n";
+
     foreach my $haplotype (@haplotypes) {
        fetchFile("$base/0-mercounts-$haplotype/$haplotype.ms$merSize.threshold");
        open(T, "< haplotype/0-mercounts-$haplotype/$haplotype.ms$merSize.threshold") or caExit("can't open haplotype/0-mercounts-$haplotype/$haplotype.ms$merSize.threshold", undef);
@@ -273,24 +270,13 @@ sub haplotypeConfigure ($) {
        $hi = $2;
        close(T);
 
-       print F "\$bin/simple-dump \\\n";
-       print F "  -m $merSize \\\n";
-       print F "  -s ../0-mercounts-$haplotype/$haplotype.ms$merSize.only \\\n";
-       print F "  -l $lo -h $hi -f ./results/\$jobid.fasta \\\n";
-       print F "  > ./results/\$jobid.$haplotype.WORKING \\\n";
-       print F "&& \\\n";
-       print F "mv ./results/\$jobid.$haplotype.WORKING ./results/\$jobid.$haplotype \\\n";
-       print F "\n";
+       print F "  -H $haplotype ../0-mercounts-$haplotype/$haplotype.ms$merSize.only $lo $hi \\\n";
     }
-    print F "join results/\$jobid.haplotype* |awk '{print \$1\" \"\$4\" \"\$5\" \"\$8\" \"\$NF}'|awk '{print \$1\" \"\$3/\$2\" \"\$NF/\$(NF-1)}'|awk '{if (\$2 == 0 && \$3 == 0) print \$1\" ambiguous\"; else if (\$2 < \$3) { print \$1\" haplotype2\"; } else if (\$2 > \$3) { print \$1\" haplotype1\"; } else print \$1\" ambiguous\"}'|awk '{print \$NF}'|sort |uniq -c\n";
 
-    # now classify and dump the fasta
-    print F "\$bin/splitHaplotype \\\n";
-    print F "  -S \$seqStore \\\n";
-    print F "  -p results/\$jobid \\\n";
-    print F "  -h " . join(" ", @haplotypes) . "\\\n";
+    print F "  -threads " . getGlobal("corThreads") . " \\\n";
     print F "  -cr 1 -cl " . getGlobal("minReadLength") . " \\\n";
     print F "  -b \$bgn -e \$end \\\n";
+    print F "  > ./results/\$jobid.err 2>&1 \\\n";
     print F "&& \\\n";
     print F "touch ./results/\$jobid.success \\\n";
     print F "\n";
@@ -305,6 +305,8 @@ sub merylParameters ($$) {
         $merTotal     = getGlobal("${tag}OvlMerTotal");
 
         $ffile = "$asm.ms$merSize.frequentMers.fasta";   #  The fasta file we should be creating (ends in FASTA).
+        $ffile = "$asm.ms$merSize.frequentMers.bin"      #  Or the binary list, if the mers fit in 64 bits.
+            if ($merSize <= 32);
         $ofile = "$asm.ms$merSize";                      #  The meryl database 'intermediate file'.
 
     } elsif (getGlobal("${tag}Overlapper") eq "mhap") {
@@ -418,7 +420,9 @@ sub merylConfigure ($$) {
     print F "&& \\\n";
     print F "mv ./$ofile.WORKING.mcdat ./$ofile.mcdat \\\n";
     print F "&& \\\n";
-    print F "mv ./$ofile.WORKING.mcidx ./$ofile.mcidx\n";
+    print F "mv ./$ofile.WORKING.mcidx ./$ofile.mcidx \\\n";
+    print F "&& \\\n";
+    print F "mv ./$ofile.WORKING.mcblk ./$ofile.mcblk\n";
     print F "\n";
     print F stashFileShellCode("$path", "$ofile.mcdat", "");
     print F "\n";
@@ -630,6 +634,7 @@ sub merylFinishSubtraction($$) {
 
     unlink "$path/$ofile.mcidx"   if (getGlobal("saveMerCounts") == 0);
     unlink "$path/$ofile.mcdat"   if (getGlobal("saveMerCounts") == 0);
+    unlink "$path/$ofile.mcblk"   if (getGlobal("saveMerCounts") == 0);
 
     generateReport($asm);
     emitStage($asm, "$tag-meryl");
@@ -713,7 +718,9 @@ sub merylProcess ($$) {
             caFailure("meryl can't dump frequent mers, databases don't exist.  Remove $path/meryl.success to try again.", undef);
         }
 
-        if (runCommand($path, "$bin/meryl -Dt -n $merThresh -s ./$ofile > ./$ffile 2> ./$ffile.err")) {
+        my $dump = ($merSize <= 32) ? "-Db" : "-Dt";
+
+        if (runCommand($path, "$bin/meryl $dump -n $merThresh -s ./$ofile > ./$ffile 2> ./$ffile.err")) {
             unlink "$path/$ffile";
             caFailure("meryl failed to dump frequent mers", "$path/$ffile.err");
         }
@@ -864,6 +871,7 @@ sub merylProcess ($$) {
 
     unlink "$path/$ofile.mcidx"   if (getGlobal("saveMerCounts") == 0);
     unlink "$path/$ofile.mcdat"   if (getGlobal("saveMerCounts") == 0);
+    unlink "$path/$ofile.mcblk"   if (getGlobal("saveMerCounts") == 0);
 
     generateReport($asm);
     emitStage($asm, "$tag-meryl");
@@ -83,6 +83,8 @@ sub trimReads ($) {
     #$cmd .= "  -Cm ./$asm.max.clear \\\n"          if (-e "./$asm.max.clear");
     $cmd .= "  -ol " . getGlobal("trimReadsOverlap") . " \\\n";
     $cmd .= "  -oc " . getGlobal("trimReadsCoverage") . " \\\n";
+    $cmd .= "  -threads " . getGlobal("executiveThreads") . " \\\n";
+    $cmd .= "  -split ./$asm.2.splitReads \\\n"   if (getGlobal("trimReadsSplit") == 1);
     $cmd .= "  -o  ./$asm.1.trimReads \\\n";
     $cmd .= ">     ./$asm.1.trimReads.err 2>&1";
 
@@ -107,6 +109,24 @@ sub trimReads ($) {
 
     addToReport("trimming", $report);
 
+    #  If reads were split too, save those results; splitReads() will then skip.
+
+    if (getGlobal("trimReadsSplit") == 1) {
+        caFailure("trimReads finished, but no '$asm.2.splitReads.clear' output found", undef)  if (! -e "$path/$asm.2.splitReads.clear");
+
+        stashFile("./trimming/3-overlapbasedtrimming/$asm.2.splitReads.clear");
+
+        $report = undef;
+
+        open(F, "< trimming/3-overlapbasedtrimming/$asm.2.splitReads.stats") or caExit("can't open 'trimming/3-overlapbasedtrimming/$asm.2.splitReads.stats' for reading: $!", undef);
+        while (<F>) {
+            $report .= "--  $_";
+        }
+        close(F);
+
+        addToReport("splitting", $report);
+    }
+
 
     if (0) {
         $cmd  = "$bin/sqStoreDumpFASTQ \\\n";
@@ -156,6 +176,7 @@ sub splitReads ($) {
     $cmd .= "  -Co ./$asm.2.splitReads.clear \\\n";
     $cmd .= "  -e  $erate \\\n";
     $cmd .= "  -minlength " . getGlobal("minReadLength") . " \\\n";
+    $cmd .= "  -threads " . getGlobal("executiveThreads") . " \\\n";
     $cmd .= "  -o  ./$asm.2.splitReads \\\n";
     $cmd .= ">     ./$asm.2.splitReads.err 2>&1";
 
@@ -291,6 +312,7 @@ sub dumpTrimmedReads ($) {
         $cmd .= "  -o ./$asm.trimmedReads.gz \\\n";
         $cmd .= "  -fasta \\\n";
         $cmd .= "  -nolibname \\\n";
+        $cmd .= "  -threads " . getGlobal("executiveThreads") . " \\\n";
         $cmd .= "> ./$asm.trimmedReads.fasta.err 2>&1";
 
         if (runCommand(".", $cmd)) {
@@ -64,7 +64,39 @@ use canu::Grid_Cloud;
 #  load the same slice from each bucket.
 
 
-#  NOT FILTERING overlaps by error rate when building the parallel store.
+#  Overlaps that the consumer of the store will never use are filtered out as the store is built
+#  (in the bucketizer for the parallel store), so they never reach the sort or the final store.
+#  Unitigging overlaps are only filtered by error rate if overlap error adjustment is disabled;
+#  OEA can lower the error rate of an overlap after the store is built.
+
+sub overlapStoreFilterOptions ($) {
+    my $tag  = shift @_;
+    my @opts;
+
+    if      ($tag eq "cor") {
+        push @opts, "-e " . getGlobal("corMaxEvidenceErate")   if (defined(getGlobal("corMaxEvidenceErate")));
+        push @opts, "-l " . getGlobal("corMinEvidenceLength")  if (defined(getGlobal("corMinEvidenceLength")));
+    } elsif ($tag eq "obt") {
+        push @opts, "-e " . getGlobal("obtErrorRate");
+    } elsif ($tag eq "utg") {
+        push @opts, "-e " . getGlobal("utgErrorRate")          if (getGlobal("enableOEA") == 0);
+    }
+
+    return(join(" ", @opts));
+}
+
+#  Overlaps beyond the best ovsMaxPerRead for each read are discarded after sorting.
+
+sub overlapStoreLimitOptions () {
+    my @opts;
+
+    if (defined(getGlobal("ovsMaxPerRead"))) {
+        push @opts, "-maxperread " . getGlobal("ovsMaxPerRead");
+        push @opts, "-score "      . getGlobal("ovsMaxPerReadScore");
+    }
+
+    return(join(" ", @opts));
+}
 
 
 #
@@ -164,6 +196,8 @@ sub createOverlapStoreSequential ($$$) {
         print F " -O  ./$asm.ovlStore.BUILDING \\\n";
         print F" -S ../$asm.seqStore \\\n";
         print F " -C  ./$asm.ovlStore.config \\\n";
+        print F " " . overlapStoreFilterOptions($tag) . " \\\n"  if (overlapStoreFilterOptions($tag) ne "");
+        print F " " . overlapStoreLimitOptions()        . " \\\n"  if (overlapStoreLimitOptions()        ne "");
         print F " > ./$asm.ovlStore.err 2>&1 \\\n";
         print F "&& \\\n";
         print F "mv ./$asm.ovlStore.BUILDING ./$asm.ovlStore\n";
@@ -297,6 +331,7 @@ sub createOverlapStoreParallel ($$$$$$) {
         print F "  -O  ./$asm.ovlStore.BUILDING \\\n";
         print F "  -S ../$asm.seqStore \\\n";
         print F "  -C  ./$asm.ovlStore.config \\\n";
+        print F "  " . overlapStoreFilterOptions($tag) . " \\\n"  if (overlapStoreFilterOptions($tag) ne "");
         print F "  -f \\\n";
         print F "  -b \$jobid \n";
         print F "\n";
@@ -364,7 +399,9 @@ sub createOverlapStoreParallel ($$$$$$) {
         print F "  -S ../$asm.seqStore \\\n";
         print F "  -C  ./$asm.ovlStore.config \\\n";
         print F "  -s \$jobid \\\n";
-        print F "  -M $sortMemory \n";
+        print F "  -M $sortMemory \\\n";
+        print F "  " . overlapStoreLimitOptions() . " \\\n"  if (overlapStoreLimitOptions() ne "");
+        print F "  -threads " . getGlobal("ovsThreads") . "\n";
         print F "\n";
 
         if (defined(getGlobal("objectStore"))) {